@@ -99,3 +99,32 @@ TEST_CASE("z85.wont_compile")
 	[[maybe_unused]] std::array<uint8_t, 8> b{ {1, 2, 3, 4, 5, 6, 7, 8} };
 	// auto decoded{ b | sph::views::z85_decode<wont_compile>() };
 }
+
+TEST_CASE("z85.fixed_hello_world")
+{
+	std::array<uint8_t, 8> constexpr hello_data{ {0x86, 0x4F, 0xD2, 0x6F, 0xB5, 0x59, 0xF7, 0x5B} };
+	std::array<char, 10> constexpr encoded{ sph::views::z85_encode(hello_data) };
+	static_assert(std::string_view{ encoded.data(), encoded.size() } == "HelloWorld");
+	static_assert(sph::views::z85_decode(encoded) == hello_data);
+	CHECK_EQ(std::string_view{ encoded.data(), encoded.size() }, "HelloWorld");
+	CHECK_EQ(sph::views::z85_decode(std::span{ encoded }), hello_data);
+}
+
+TEST_CASE("z85.fixed_curve_key")
+{
+	std::default_random_engine gen(std::random_device{}());
+	std::uniform_int_distribution rand(0, 255);
+	std::array<uint8_t, 32> key;
+	std::ranges::generate(key, [&rand, &gen]() -> uint8_t { return static_cast<uint8_t>(rand(gen)); });
+
+	std::array<char, 40> const encoded{ sph::views::z85_encode(std::span{ key }) };
+	auto const view_encoded{ key | sph::views::z85_encode() | std::ranges::to<std::vector>() };
+	CHECK(std::ranges::equal(encoded, view_encoded));
+
+	std::array<uint8_t, 32> const decoded{ sph::views::z85_decode(encoded) };
+	CHECK_EQ(decoded, key);
+
+	std::array<uint32_t, 8> const decoded32{ sph::views::z85_decode<uint32_t>(encoded) };
+	CHECK(std::ranges::equal(sph::views::z85_encode(decoded32), encoded));
+	CHECK(std::ranges::equal(decoded32, encoded | sph::views::z85_decode<uint32_t>()));
+}
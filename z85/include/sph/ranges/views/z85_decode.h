@@ -1,15 +1,97 @@
 #pragma once
 #include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
 #include <format>
 #include <optional>
 #include <ranges>
+#include <span>
 #include <stdexcept>
+#include <type_traits>
+#include <utility>
 #include <variant>
 
 namespace sph::ranges::views
 {
     namespace detail
     {
+        // 128 entries so any (c - 32) & 127 index is in range; entries past 95 are not Z85 characters.
+        inline std::array<unsigned char, 128> constexpr z85_base256{ {
+            0x00, 0x44, 0x00, 0x54, 0x53, 0x52, 0x48, 0x00,
+            0x4B, 0x4C, 0x46, 0x41, 0x00, 0x3F, 0x3E, 0x45,
+            0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+            0x08, 0x09, 0x40, 0x00, 0x49, 0x42, 0x4A, 0x47,
+            0x51, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2A,
+            0x2B, 0x2C, 0x2D, 0x2E, 0x2F, 0x30, 0x31, 0x32,
+            0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3A,
+            0x3B, 0x3C, 0x3D, 0x4D, 0x00, 0x4E, 0x43, 0x00,
+            0x00, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10,
+            0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18,
+            0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20,
+            0x21, 0x22, 0x23, 0x4F, 0x00, 0x50, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+        } };
+
+        /**
+         * @brief Decodes 5 Z85 characters into a big-endian 32-bit value.
+         * @param in The 5 characters to decode.
+         * @return The decoded value.
+         */
+        template<typename C>
+        constexpr auto z85_decode_chunk(C const* in) -> uint32_t
+        {
+            uint32_t value{ z85_base256[(static_cast<size_t>(in[0]) - 32) & 127] };
+            value = (value * 85) + z85_base256[(static_cast<size_t>(in[1]) - 32) & 127];
+            value = (value * 85) + z85_base256[(static_cast<size_t>(in[2]) - 32) & 127];
+            value = (value * 85) + z85_base256[(static_cast<size_t>(in[3]) - 32) & 127];
+            value = (value * 85) + z85_base256[(static_cast<size_t>(in[4]) - 32) & 127];
+            return value;
+        }
+
+        /**
+         * @brief Decodes a fixed-size Z85 input with a fully unrolled loop and no runtime size checks.
+         *
+         * Unlike z85_decode_view, invalid characters are not skipped; the input must be exactly the encoded text.
+         * @tparam T The output value type.
+         * @tparam C The input character type.
+         * @tparam N The number of input characters.
+         * @param input The characters to decode. Must be a multiple of 5.
+         * @return The decoded values.
+         */
+        template<typename T, typename C, size_t N>
+            requires std::is_trivially_copyable_v<T> && (sizeof(C) == 1) && (N != std::dynamic_extent)
+        constexpr auto z85_decode_fixed(std::span<C const, N> input) -> std::array<T, N / 5 * 4 / sizeof(T)>
+        {
+            static_assert(N % 5 == 0, "z85_decode requires input to be a multiple of 5 characters");
+            static_assert((N / 5 * 4) % sizeof(T) == 0, "z85_decode requires the decoded size to be a multiple of the output type size");
+            std::array<uint8_t, N / 5 * 4> ret{};
+            auto const decode_chunk{ [&ret, input](size_t i)
+            {
+                uint32_t const value{ z85_decode_chunk(input.data() + i * 5) };
+                ret[i * 4] = static_cast<uint8_t>(value >> 24);
+                ret[i * 4 + 1] = static_cast<uint8_t>(value >> 16);
+                ret[i * 4 + 2] = static_cast<uint8_t>(value >> 8);
+                ret[i * 4 + 3] = static_cast<uint8_t>(value);
+            } };
+            [&decode_chunk]<size_t... I>(std::index_sequence<I...>)
+            {
+                (decode_chunk(I), ...);
+            }(std::make_index_sequence<N / 5>{});
+
+            if constexpr (std::is_same_v<T, uint8_t>)
+            {
+                return ret;
+            }
+            else
+            {
+                return std::bit_cast<std::array<T, N / 5 * 4 / sizeof(T)>>(ret);
+            }
+        }
+
         /**
 		 * @brief A view that decodes Z85-encoded data into binary data by converting every 5 characters into 4 bytes.
 		 * @tparam R The input range type
@@ -46,20 +128,6 @@ namespace sph::ranges::views
 				using reference = const T&;
                 using input_type = std::remove_cvref_t<std::ranges::range_value_t<R>>;
             private:
-                static std::array<unsigned char, 96> constexpr base256{ {
-				    0x00, 0x44, 0x00, 0x54, 0x53, 0x52, 0x48, 0x00,
-				    0x4B, 0x4C, 0x46, 0x41, 0x00, 0x3F, 0x3E, 0x45,
-				    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
-				    0x08, 0x09, 0x40, 0x00, 0x49, 0x42, 0x4A, 0x47,
-				    0x51, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2A,
-				    0x2B, 0x2C, 0x2D, 0x2E, 0x2F, 0x30, 0x31, 0x32,
-				    0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3A,
-				    0x3B, 0x3C, 0x3D, 0x4D, 0x00, 0x4E, 0x43, 0x00,
-				    0x00, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10,
-				    0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18,
-				    0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20,
-				    0x21, 0x22, 0x23, 0x4F, 0x00, 0x50, 0x00, 0x00
-				} };
                 // filter invalid z85 characters - this allows splitting strings with newlines or any other odd thing.
                 static std::array<uint8_t, 256> constexpr valid{ {
                         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -173,11 +241,7 @@ namespace sph::ranges::views
                 {
 	                if (std::optional<std::array<char, 5>> const chunk{ next_value() })
                     {
-                        uint32_t value{ base256[(static_cast<size_t>((*chunk)[0]) - 32) & 127]};
-                        value = (value * 85) + base256[(static_cast<size_t>((*chunk)[1]) - 32) & 127];
-                        value = (value * 85) + base256[(static_cast<size_t>((*chunk)[2]) - 32) & 127];
-                        value = (value * 85) + base256[(static_cast<size_t>((*chunk)[3]) - 32) & 127];
-                        value = (value * 85) + base256[(static_cast<size_t>((*chunk)[4]) - 32) & 127];
+                        uint32_t const value{ z85_decode_chunk(chunk->data()) };
                         buffer_[0] = static_cast<unsigned char>(value >> 24);
                         buffer_[1] = static_cast<unsigned char>(value >> 16);
                         buffer_[2] = static_cast<unsigned char>(value >> 8);
@@ -298,4 +362,40 @@ namespace sph::views
     {
         return {};
     }
+
+	/**
+	 * @brief Decodes a fixed-size span of Z85 characters (e.g., a 40-character CURVE key) into binary data.
+	 *
+	 * The size is validated at compile time and the decoding is fully unrolled. Unlike the view adaptor,
+	 * invalid characters are not skipped.
+	 * @tparam T The type of the decoded values (defaults to uint8_t).
+	 * @tparam C The input character type.
+	 * @tparam N The static extent of the span. Must be a multiple of 5.
+	 * @param input The characters to decode.
+	 * @return The decoded values.
+	 */
+    template<typename T = uint8_t, typename C, size_t N>
+        requires std::is_trivially_copyable_v<T> && (sizeof(C) == 1) && (N != std::dynamic_extent)
+    constexpr auto z85_decode(std::span<C, N> input) -> std::array<T, N / 5 * 4 / sizeof(T)>
+    {
+        return sph::ranges::views::detail::z85_decode_fixed<T>(std::span<std::remove_cv_t<C> const, N>{ input });
+    }
+
+	/**
+	 * @brief Decodes a fixed-size array of Z85 characters (e.g., a 40-character CURVE key) into binary data.
+	 *
+	 * The size is validated at compile time and the decoding is fully unrolled. Unlike the view adaptor,
+	 * invalid characters are not skipped.
+	 * @tparam T The type of the decoded values (defaults to uint8_t).
+	 * @tparam C The input character type.
+	 * @tparam N The number of array elements. Must be a multiple of 5.
+	 * @param input The characters to decode.
+	 * @return The decoded values.
+	 */
+    template<typename T = uint8_t, typename C, size_t N>
+        requires std::is_trivially_copyable_v<T> && (sizeof(C) == 1)
+    constexpr auto z85_decode(std::array<C, N> const& input) -> std::array<T, N / 5 * 4 / sizeof(T)>
+    {
+        return sph::ranges::views::detail::z85_decode_fixed<T>(std::span<C const, N>{ input });
+    }
 }
\ No newline at end of file
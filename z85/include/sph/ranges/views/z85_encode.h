@@ -1,15 +1,84 @@
 #pragma once
 #include <algorithm>
 #include <array>
+#include <cstddef>
 #include <cstdint>
 #include <ranges>
+#include <span>
 #include <stdexcept>
+#include <string_view>
+#include <type_traits>
+#include <utility>
 #include <fmt/format.h>
 
 namespace sph::ranges::views
 {
     namespace detail
     {
+        inline std::string_view constexpr z85_base85{
+            "0123456789abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ.-:+=^!/*?&<>()[]{}@%$#"
+        };
+
+        constexpr auto div85(uint32_t v) -> uint32_t
+        {
+            uint64_t constexpr div85_magic{ 3233857729ULL };
+            return static_cast<uint32_t>((div85_magic * v) >> 38);
+        }
+
+        /**
+         * @brief Encodes a big-endian 32-bit value into 5 Z85 characters.
+         * @param value The value to encode.
+         * @param out Where to write the 5 characters.
+         */
+        constexpr void z85_encode_chunk(uint32_t value, char* out)
+        {
+            uint32_t value2 = div85(value);
+            out[4] = z85_base85[value - (value2 * 85)];
+            value = value2;
+            value2 = div85(value);
+            out[3] = z85_base85[value - (value2 * 85)];
+            value = value2;
+            value2 = div85(value);
+            out[2] = z85_base85[value - (value2 * 85)];
+            value = value2;
+            value2 = div85(value);
+            out[1] = z85_base85[value - (value2 * 85)];
+            out[0] = z85_base85[value2];
+        }
+
+        /**
+         * @brief Encodes a fixed-size input into Z85 with a fully unrolled loop and no runtime size checks.
+         * @tparam T The input element type.
+         * @tparam N The number of input elements.
+         * @param input The data to encode. Its size in bytes must be a multiple of 4.
+         * @return The N * sizeof(T) / 4 * 5 encoded characters.
+         */
+        template<typename T, size_t N>
+            requires std::is_standard_layout_v<T> && (N != std::dynamic_extent)
+        constexpr auto z85_encode_fixed(std::span<T const, N> input) -> std::array<char, N * sizeof(T) / 4 * 5>
+        {
+            static_assert((N * sizeof(T)) % 4 == 0, "Z85 encode requires input size to be multiple of 4");
+            auto const byte_at{ [input](size_t i) -> uint32_t
+            {
+                if constexpr (sizeof(T) == 1)
+                {
+                    return static_cast<uint32_t>(static_cast<uint8_t>(input[i]));
+                }
+                else
+                {
+                    return static_cast<uint32_t>(reinterpret_cast<uint8_t const*>(input.data())[i]);
+                }
+            } };
+            std::array<char, N * sizeof(T) / 4 * 5> ret{};
+            [&ret, &byte_at]<size_t... I>(std::index_sequence<I...>)
+            {
+                (z85_encode_chunk(
+                    (byte_at(I * 4) << 24) | (byte_at(I * 4 + 1) << 16) | (byte_at(I * 4 + 2) << 8) | byte_at(I * 4 + 3),
+                    ret.data() + I * 5), ...);
+            }(std::make_index_sequence<N * sizeof(T) / 4>{});
+            return ret;
+        }
+
         /**
          * @brief A view that encodes binary data into Z85-encoded data into by converting every 4 bytes into 5 characters.
          * @tparam R The input range type
@@ -61,9 +130,6 @@ namespace sph::ranges::views
                 using difference_type = std::ptrdiff_t;
                 using input_type = std::remove_cvref_t<std::ranges::range_value_t<R>>;
             private:
-                static std::string_view constexpr base85{
-					"0123456789abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ.-:+=^!/*?&<>()[]{}@%$#"
-                };
                 std::ranges::const_iterator_t<R> current_;
                 std::ranges::const_sentinel_t<R> end_;
                 size_t buffer_pos_;
@@ -150,31 +216,12 @@ namespace sph::ranges::views
                     }
                 }
 
-                static constexpr auto div85(uint32_t v) -> uint32_t
-                {
-                    static uint64_t constexpr div85_magic{ 3233857729ULL };
-                    return static_cast<uint32_t>((div85_magic * v) >> 38);
-                }
-
                 void load_next_chunk()
             	{
                     if (current_ != end_ || !at_end_of_input_value())
                     {
-	                    uint32_t value{ next_value() };
-
 	                    // convert uint32_t elements into 5-char elements
-	                    uint32_t value2 = div85(value);
-	                    buffer_[4] = base85[value - (value2 * 85)];
-	                    value = value2;
-	                    value2 = div85(value);
-	                    buffer_[3] = base85[value - (value2 * 85)];
-	                    value = value2;
-	                    value2 = div85(value);
-	                    buffer_[2] = base85[value - (value2 * 85)];
-	                    value = value2;
-	                    value2 = div85(value);
-	                    buffer_[1] = base85[value - (value2 * 85)];
-	                    buffer_[0] = base85[value2];
+	                    z85_encode_chunk(next_value(), buffer_.data());
 	                    buffer_pos_ = 0;
                     }
                 }
@@ -268,4 +315,36 @@ namespace sph::views
     {
         return {};
     }
+
+	/**
+	 * @brief Encodes a fixed-size span (e.g., a 32-byte CURVE key) into Z85 characters.
+	 *
+	 * The size is validated at compile time and the encoding is fully unrolled.
+	 * @tparam T The input element type.
+	 * @tparam N The static extent of the span.
+	 * @param input The data to encode. Its size in bytes must be a multiple of 4.
+	 * @return The encoded characters.
+	 */
+    template<typename T, size_t N>
+        requires std::is_standard_layout_v<T> && (N != std::dynamic_extent)
+    constexpr auto z85_encode(std::span<T, N> input) -> std::array<char, N * sizeof(T) / 4 * 5>
+    {
+        return sph::ranges::views::detail::z85_encode_fixed(std::span<std::remove_cv_t<T> const, N>{ input });
+    }
+
+	/**
+	 * @brief Encodes a fixed-size array (e.g., a 32-byte CURVE key) into Z85 characters.
+	 *
+	 * The size is validated at compile time and the encoding is fully unrolled.
+	 * @tparam T The input element type.
+	 * @tparam N The number of array elements.
+	 * @param input The data to encode. Its size in bytes must be a multiple of 4.
+	 * @return The encoded characters.
+	 */
+    template<typename T, size_t N>
+        requires std::is_standard_layout_v<T>
+    constexpr auto z85_encode(std::array<T, N> const& input) -> std::array<char, N * sizeof(T) / 4 * 5>
+    {
+        return sph::ranges::views::detail::z85_encode_fixed(std::span<T const, N>{ input });
+    }
 }
\ No newline at end of file